@@ -0,0 +1,53 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import uart
+from esphome.const import CONF_ID
+
+DEPENDENCIES = ["uart"]
+AUTO_LOAD = ["sensor"]
+
+CONF_HWT905_ID = "hwt905_id"
+CONF_VIBRATION_WINDOW_SIZE = "vibration_window_size"
+
+# Output rate set by the firmware when vibration monitoring is enabled
+HWT905_OUTPUT_RATE_HZ = 100
+
+hwt905_ns = cg.esphome_ns.namespace("hwt905")
+HWT905Sensor = hwt905_ns.class_("HWT905Sensor", cg.PollingComponent, uart.UARTDevice)
+
+
+def validate_window_size(value):
+    value = cv.int_range(min=8, max=128)(value)
+    if value & (value - 1):
+        raise cv.Invalid("vibration_window_size must be a power of two")
+    return value
+
+
+CONFIG_SCHEMA = (
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(HWT905Sensor),
+            # ~0.32s at the 100Hz output rate used for vibration monitoring
+            cv.Optional(CONF_VIBRATION_WINDOW_SIZE, default=32): validate_window_size,
+        }
+    )
+    .extend(cv.polling_component_schema("100ms"))
+    .extend(uart.UART_DEVICE_SCHEMA)
+)
+
+FINAL_VALIDATE_SCHEMA = uart.final_validate_device_schema(
+    "hwt905", require_tx=True, require_rx=True
+)
+
+
+def enable_vibration_monitor():
+    """Compile in the streaming vibration statistics (vibration sensors or wind stow)."""
+    cg.add_define("USE_HWT905_VIBRATION")
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    await uart.register_uart_device(var, config)
+
+    cg.add_define("HWT905_VIBRATION_WINDOW_SIZE", config[CONF_VIBRATION_WINDOW_SIZE])
@@ -0,0 +1,548 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/uart/uart.h"
+
+// HWT905 Protocol Constants
+#define HWT905_TIME_PACKET      0x50
+#define HWT905_ACCEL_PACKET     0x51
+#define HWT905_GYRO_PACKET      0x52
+#define HWT905_ANGLE_PACKET     0x53
+#define HWT905_MAG_PACKET       0x54
+
+#define HWT905_HEADER           0x55
+#define HWT905_PACKET_SIZE      11
+
+#define HWT905_CMD_SAVE         0x00
+#define HWT905_CMD_CALIBRATE    0x01
+#define HWT905_CMD_EXIT_CALIB   0x00
+
+// Calibration commands as per HWT905 documentation
+#define HWT905_UNLOCK_REG       0x69
+#define HWT905_ACCEL_CALIB      0x01
+#define HWT905_MAG_CALIB        0x07
+#define HWT905_EXIT_CALIB       0x00
+#define HWT905_SAVE_CONFIG      0x00
+
+// Unlock frame is FF AA 69 88 B5
+#define HWT905_UNLOCK_KEY_LOW   0x88
+#define HWT905_UNLOCK_KEY_HIGH  0xB5
+
+// Output rate register (vibration monitoring needs the full IMU rate)
+#define HWT905_RATE_REG         0x03
+#define HWT905_RATE_100HZ       0x09
+// Below this measured accel rate the vibration window no longer spans its nominal time
+#define HWT905_MIN_VIBRATION_RATE_HZ  80
+
+// Sliding window for vibration statistics (power of two, set from YAML)
+#ifndef HWT905_VIBRATION_WINDOW_SIZE
+#define HWT905_VIBRATION_WINDOW_SIZE  32
+#endif
+
+namespace esphome {
+namespace hwt905 {
+
+#ifdef USE_HWT905_VIBRATION
+/**
+ * Streaming vibration statistics over a sliding window of accel samples
+ * Variance is kept as exact integer running sums of the raw counts, and
+ * peak-to-peak uses monotonic min/max queues, so every sample is O(1)
+ * amortized with fixed memory
+ */
+template<uint16_t WindowSize> class VibrationMonitor {
+ public:
+  VibrationMonitor() {
+    memset(axes_, 0, sizeof(axes_));
+  }
+
+  void add_sample(int16_t ax, int16_t ay, int16_t az) {
+    int16_t values[3] = {ax, ay, az};
+    uint16_t slot = sample_seq_ % WindowSize;
+
+    for (int i = 0; i < 3; i++) {
+      AxisWindow &axis = axes_[i];
+
+      // Drop the oldest sample from the running sums once the window is full
+      if (count_ == WindowSize) {
+        int32_t old = axis.samples[slot];
+        axis.sum -= old;
+        axis.sum_sq -= (int64_t)old * old;
+      }
+
+      int32_t value = values[i];
+      axis.samples[slot] = values[i];
+      axis.sum += value;
+      axis.sum_sq += (int64_t)value * value;
+
+      push_max(axis, values[i]);
+      push_min(axis, values[i]);
+    }
+
+    sample_seq_++;
+    if (count_ < WindowSize) {
+      count_++;
+    }
+  }
+
+  bool is_window_full() const {
+    return count_ == WindowSize;
+  }
+
+  /**
+   * Total RMS deviation from the window mean across all three axes (m/s²)
+   * Static gravity drops out, leaving only the dynamic (vibration) part
+   */
+  float get_rms() const {
+    if (count_ < 2) return 0.0;
+
+    float variance = 0.0;
+    for (int i = 0; i < 3; i++) {
+      const AxisWindow &axis = axes_[i];
+      // n*sum_sq - sum^2 is exact in 64-bit for int16 windows up to 128 samples
+      int64_t scaled = (int64_t)count_ * axis.sum_sq - (int64_t)axis.sum * axis.sum;
+      variance += (float)scaled / ((float)count_ * count_);
+    }
+
+    return sqrtf(variance) * ACCEL_SCALE;
+  }
+
+  /**
+   * Largest peak-to-peak swing of any single axis in the window (m/s²)
+   */
+  float get_peak_to_peak() const {
+    if (count_ == 0) return 0.0;
+
+    int32_t largest = 0;
+    for (int i = 0; i < 3; i++) {
+      const AxisWindow &axis = axes_[i];
+      int32_t high = axis.samples[axis.max_queue[axis.max_head] % WindowSize];
+      int32_t low = axis.samples[axis.min_queue[axis.min_head] % WindowSize];
+      if (high - low > largest) {
+        largest = high - low;
+      }
+    }
+
+    return largest * ACCEL_SCALE;
+  }
+
+ private:
+  static_assert((WindowSize & (WindowSize - 1)) == 0,
+                "Vibration window size must be a power of two");
+
+  // Raw count to m/s² (range ±16g)
+  static constexpr float ACCEL_SCALE = 16.0f * 9.81f / 32768.0f;
+
+  // Queues hold 16-bit sample sequence numbers; the window size divides
+  // 65536, so seq % WindowSize stays valid across wraparound
+  struct AxisWindow {
+    int16_t samples[WindowSize];
+    int32_t sum;
+    int64_t sum_sq;
+    uint16_t max_queue[WindowSize];
+    uint16_t min_queue[WindowSize];
+    uint8_t max_head, max_size;
+    uint8_t min_head, min_size;
+  };
+
+  AxisWindow axes_[3];
+  uint16_t sample_seq_ = 0;
+  uint16_t count_ = 0;
+
+  void push_max(AxisWindow &axis, int16_t value) {
+    expire(axis.max_queue, axis.max_head, axis.max_size);
+    // Anything smaller than the new sample can never be the window max again
+    while (axis.max_size > 0 &&
+           axis.samples[queue_back(axis.max_queue, axis.max_head, axis.max_size) % WindowSize] <= value) {
+      axis.max_size--;
+    }
+    axis.max_queue[(axis.max_head + axis.max_size) % WindowSize] = sample_seq_;
+    axis.max_size++;
+  }
+
+  void push_min(AxisWindow &axis, int16_t value) {
+    expire(axis.min_queue, axis.min_head, axis.min_size);
+    while (axis.min_size > 0 &&
+           axis.samples[queue_back(axis.min_queue, axis.min_head, axis.min_size) % WindowSize] >= value) {
+      axis.min_size--;
+    }
+    axis.min_queue[(axis.min_head + axis.min_size) % WindowSize] = sample_seq_;
+    axis.min_size++;
+  }
+
+  // Pop the front entry if it has slid out of the window (or is about to be overwritten)
+  void expire(uint16_t *queue, uint8_t &head, uint8_t &size) {
+    if (size > 0 && (uint16_t)(sample_seq_ - queue[head]) >= WindowSize) {
+      head = (head + 1) % WindowSize;
+      size--;
+    }
+  }
+
+  uint16_t queue_back(const uint16_t *queue, uint8_t head, uint8_t size) const {
+    return queue[(head + size - 1) % WindowSize];
+  }
+};
+#endif  // USE_HWT905_VIBRATION
+
+/**
+ * HWT905 9-axis IMU Sensor Component
+ * Communicates via RS485 UART
+ * Provides roll, pitch, yaw (heading), acceleration and vibration data
+ * Sensors are optional; only those configured under `platform: hwt905` are published
+ */
+class HWT905Sensor : public PollingComponent, public uart::UARTDevice {
+ public:
+  HWT905Sensor() {
+    memset(rx_buffer_, 0, sizeof(rx_buffer_));
+    rx_index_ = 0;
+  }
+
+  void set_elevation_sensor(sensor::Sensor *sens) { elevation_sensor_ = sens; }
+  void set_heading_sensor(sensor::Sensor *sens) { heading_sensor_ = sens; }
+  void set_acceleration_x_sensor(sensor::Sensor *sens) { accel_x_sensor_ = sens; }
+  void set_acceleration_y_sensor(sensor::Sensor *sens) { accel_y_sensor_ = sens; }
+  void set_acceleration_z_sensor(sensor::Sensor *sens) { accel_z_sensor_ = sens; }
+#ifdef USE_HWT905_VIBRATION
+  void set_vibration_rms_sensor(sensor::Sensor *sens) { vibration_rms_sensor_ = sens; }
+  void set_vibration_peak_to_peak_sensor(sensor::Sensor *sens) { vibration_p2p_sensor_ = sens; }
+#endif
+
+  void setup() override {
+    ESP_LOGCONFIG("HWT905", "Setting up HWT905 sensor...");
+    
+    // Wait for sensor to initialize
+    delay(1000);
+    
+#ifdef USE_HWT905_VIBRATION
+    // The output rate is only rewritten if the measured rate is too low, so the
+    // IMU's stored config isn't saved again on every boot
+    accel_rate_start_ = millis();
+    accel_packet_count_ = 0;
+#endif
+    
+    // Request initial data
+    request_data();
+  }
+
+  void update() override {
+    // Read available data from UART
+    while (available()) {
+      uint8_t byte;
+      read_byte(&byte);
+      process_byte(byte);
+    }
+    
+    // Periodically request data
+    request_data_counter_++;
+    if (request_data_counter_ >= 10) {  // Every ~1 second
+      request_data();
+      request_data_counter_ = 0;
+    }
+    
+    // Packets arrive at up to 100Hz; only the latest values are published
+    if (angles_updated_) {
+      if (elevation_sensor_ != nullptr) elevation_sensor_->publish_state(current_elevation_);
+      if (heading_sensor_ != nullptr) heading_sensor_->publish_state(current_heading_);
+      angles_updated_ = false;
+    }
+    
+    if (accel_updated_) {
+      if (accel_x_sensor_ != nullptr) accel_x_sensor_->publish_state(current_accel_x_);
+      if (accel_y_sensor_ != nullptr) accel_y_sensor_->publish_state(current_accel_y_);
+      if (accel_z_sensor_ != nullptr) accel_z_sensor_->publish_state(current_accel_z_);
+      accel_updated_ = false;
+    }
+    
+#ifdef USE_HWT905_VIBRATION
+    update_accel_rate();
+    
+    // Publish vibration statistics at the polling rate rather than the IMU rate
+    if (vibration_.is_window_full()) {
+      if (vibration_rms_sensor_ != nullptr)
+        vibration_rms_sensor_->publish_state(vibration_.get_rms());
+      if (vibration_p2p_sensor_ != nullptr)
+        vibration_p2p_sensor_->publish_state(vibration_.get_peak_to_peak());
+    }
+#endif
+  }
+
+  void loop() override {
+    // Process any incoming bytes
+    while (available()) {
+      uint8_t byte;
+      read_byte(&byte);
+      process_byte(byte);
+    }
+  }
+
+  /**
+   * Calibrate the sensor (accelerometer and magnetometer)
+   * As per HWT905 documentation
+   */
+  void calibrate() {
+    ESP_LOGI("HWT905", "Starting calibration sequence...");
+    
+    // Unlock configuration registers
+    unlock_config();
+    
+    // Start accelerometer calibration
+    ESP_LOGI("HWT905", "Calibrating accelerometer - keep device level and stable");
+    send_command(0x01, HWT905_ACCEL_CALIB, 0x00, 0x00);
+    delay(5000);  // Wait 5 seconds for accel calibration
+    
+    // Exit accelerometer calibration
+    send_command(0x01, HWT905_EXIT_CALIB, 0x00, 0x00);
+    delay(100);
+    
+    // Start magnetometer calibration
+    ESP_LOGI("HWT905", "Calibrating magnetometer - rotate device in figure-8 pattern");
+    send_command(0x01, HWT905_MAG_CALIB, 0x00, 0x00);
+    delay(15000);  // Wait 15 seconds for mag calibration
+    
+    // Exit magnetometer calibration
+    send_command(0x01, HWT905_EXIT_CALIB, 0x00, 0x00);
+    delay(100);
+    
+    // Save configuration
+    ESP_LOGI("HWT905", "Saving calibration data...");
+    send_command(0x00, HWT905_SAVE_CONFIG, 0x00, 0x00);
+    delay(500);
+    
+    ESP_LOGI("HWT905", "Calibration complete!");
+  }
+
+  float get_current_elevation() {
+    return current_elevation_;
+  }
+
+  float get_current_heading() {
+    return current_heading_;
+  }
+
+#ifdef USE_HWT905_VIBRATION
+  /**
+   * Statistics are only trusted once the window is full and accel packets
+   * actually arrive at the configured rate (e.g. the rate write was accepted)
+   */
+  bool is_vibration_valid() {
+    return vibration_.is_window_full() && accel_rate_ok_;
+  }
+
+  float get_accel_rate() {
+    return accel_rate_hz_;
+  }
+
+  float get_vibration_rms() {
+    return vibration_.get_rms();
+  }
+
+  float get_vibration_peak_to_peak() {
+    return vibration_.get_peak_to_peak();
+  }
+#endif
+
+ private:
+  uint8_t rx_buffer_[HWT905_PACKET_SIZE];
+  uint8_t rx_index_;
+  int request_data_counter_ = 0;
+  
+  float current_elevation_ = 0.0;
+  float current_heading_ = 0.0;
+  float current_roll_ = 0.0;
+  float current_accel_x_ = 0.0;
+  float current_accel_y_ = 0.0;
+  float current_accel_z_ = 0.0;
+  bool angles_updated_ = false;
+  bool accel_updated_ = false;
+  
+  sensor::Sensor *elevation_sensor_{nullptr};
+  sensor::Sensor *heading_sensor_{nullptr};
+  sensor::Sensor *accel_x_sensor_{nullptr};
+  sensor::Sensor *accel_y_sensor_{nullptr};
+  sensor::Sensor *accel_z_sensor_{nullptr};
+  
+#ifdef USE_HWT905_VIBRATION
+  sensor::Sensor *vibration_rms_sensor_{nullptr};
+  sensor::Sensor *vibration_p2p_sensor_{nullptr};
+  VibrationMonitor<HWT905_VIBRATION_WINDOW_SIZE> vibration_;
+  
+  // Measured accel packet rate
+  uint32_t accel_packet_count_ = 0;
+  unsigned long accel_rate_start_ = 0;
+  float accel_rate_hz_ = 0.0;
+  bool accel_rate_ok_ = false;
+  bool output_rate_written_ = false;
+#endif
+
+  void process_byte(uint8_t byte) {
+    // Looking for packet header
+    if (rx_index_ == 0) {
+      if (byte == HWT905_HEADER) {
+        rx_buffer_[rx_index_++] = byte;
+      }
+    } else if (rx_index_ == 1) {
+      // Second byte is packet type
+      rx_buffer_[rx_index_++] = byte;
+      
+      // Validate packet type
+      if (byte < 0x50 || byte > 0x5F) {
+        rx_index_ = 0;  // Reset on invalid packet type
+      }
+    } else {
+      rx_buffer_[rx_index_++] = byte;
+      
+      // Full packet received
+      if (rx_index_ >= HWT905_PACKET_SIZE) {
+        if (validate_checksum(rx_buffer_, HWT905_PACKET_SIZE)) {
+          parse_packet(rx_buffer_);
+        } else {
+          ESP_LOGW("HWT905", "Checksum failed");
+        }
+        rx_index_ = 0;
+      }
+    }
+  }
+
+  bool validate_checksum(uint8_t *data, uint8_t len) {
+    uint8_t sum = 0;
+    for (int i = 0; i < len - 1; i++) {
+      sum += data[i];
+    }
+    return sum == data[len - 1];
+  }
+
+  void parse_packet(uint8_t *data) {
+    uint8_t packet_type = data[1];
+    
+    switch (packet_type) {
+      case HWT905_ACCEL_PACKET: {
+        // Acceleration data (16-bit signed, LSB first)
+        int16_t ax = (int16_t)(data[3] << 8 | data[2]);
+        int16_t ay = (int16_t)(data[5] << 8 | data[4]);
+        int16_t az = (int16_t)(data[7] << 8 | data[6]);
+        
+        // Convert to m/s² (range ±16g)
+        current_accel_x_ = (ax / 32768.0) * 16.0 * 9.81;
+        current_accel_y_ = (ay / 32768.0) * 16.0 * 9.81;
+        current_accel_z_ = (az / 32768.0) * 16.0 * 9.81;
+        accel_updated_ = true;
+        
+#ifdef USE_HWT905_VIBRATION
+        vibration_.add_sample(ax, ay, az);
+        accel_packet_count_++;
+#endif
+        
+        ESP_LOGV("HWT905", "Accel: X=%.3f, Y=%.3f, Z=%.3f m/s²",
+                 current_accel_x_, current_accel_y_, current_accel_z_);
+        break;
+      }
+      
+      case HWT905_ANGLE_PACKET: {
+        // Angle data (16-bit signed, LSB first)
+        int16_t roll_raw = (int16_t)(data[3] << 8 | data[2]);
+        int16_t pitch_raw = (int16_t)(data[5] << 8 | data[4]);
+        int16_t yaw_raw = (int16_t)(data[7] << 8 | data[6]);
+        
+        // Convert to degrees (range ±180°)
+        current_roll_ = (roll_raw / 32768.0) * 180.0;
+        float pitch = (pitch_raw / 32768.0) * 180.0;
+        float yaw = (yaw_raw / 32768.0) * 180.0;
+        
+        // For solar tracker:
+        // Elevation = pitch angle (tilt up/down)
+        // Heading = yaw angle (rotation left/right)
+        current_elevation_ = pitch;
+        current_heading_ = yaw;
+        
+        // Normalize heading to 0-360
+        if (current_heading_ < 0) {
+          current_heading_ += 360.0;
+        }
+        
+        angles_updated_ = true;
+        
+        ESP_LOGV("HWT905", "Angles: Roll=%.2f°, Pitch(Elev)=%.2f°, Yaw(Head)=%.2f°", 
+                 current_roll_, current_elevation_, current_heading_);
+        break;
+      }
+      
+      default:
+        ESP_LOGV("HWT905", "Received packet type: 0x%02X", packet_type);
+        break;
+    }
+  }
+
+#ifdef USE_HWT905_VIBRATION
+  void set_output_rate(uint8_t rate) {
+    ESP_LOGCONFIG("HWT905", "Setting output rate (code 0x%02X)", rate);
+    
+    unlock_config();
+    send_command(HWT905_RATE_REG, rate, 0x00, 0x00);
+    delay(100);
+    send_command(0x00, HWT905_SAVE_CONFIG, 0x00, 0x00);
+    delay(100);
+  }
+
+  void update_accel_rate() {
+    unsigned long elapsed = millis() - accel_rate_start_;
+    if (elapsed < 1000) {
+      return;
+    }
+    
+    accel_rate_hz_ = accel_packet_count_ * 1000.0 / elapsed;
+    accel_packet_count_ = 0;
+    accel_rate_start_ = millis();
+    
+    bool ok = accel_rate_hz_ >= HWT905_MIN_VIBRATION_RATE_HZ;
+    if (ok != accel_rate_ok_) {
+      if (ok) {
+        ESP_LOGI("HWT905", "Accel rate %.0fHz - vibration monitoring active", accel_rate_hz_);
+      } else {
+        ESP_LOGW("HWT905", "Accel rate %.0fHz below %dHz - vibration monitoring suspended",
+                 accel_rate_hz_, HWT905_MIN_VIBRATION_RATE_HZ);
+      }
+      accel_rate_ok_ = ok;
+    }
+    
+    // Vibration monitoring works on every accel sample, so it needs 100Hz;
+    // write and save the rate at most once per boot
+    if (!ok && !output_rate_written_) {
+      output_rate_written_ = true;
+      set_output_rate(HWT905_RATE_100HZ);
+      accel_packet_count_ = 0;
+      accel_rate_start_ = millis();
+    }
+  }
+#endif
+
+  void unlock_config() {
+    send_command(HWT905_UNLOCK_REG, HWT905_UNLOCK_KEY_LOW, HWT905_UNLOCK_KEY_HIGH, 0x00);
+    delay(100);
+  }
+
+  void request_data() {
+    // The HWT905 automatically sends data, but we can request specific packets
+    // For now, rely on automatic transmission
+  }
+
+  void send_command(uint8_t reg, uint8_t data_high, uint8_t data_low1, uint8_t data_low2) {
+    uint8_t cmd[5];
+    cmd[0] = 0xFF;
+    cmd[1] = 0xAA;
+    cmd[2] = reg;
+    cmd[3] = data_high;
+    cmd[4] = data_low1;
+    
+    write_array(cmd, 5);
+    flush();
+    
+    ESP_LOGV("HWT905", "Sent command: REG=0x%02X, DATA=0x%02X 0x%02X 0x%02X", 
+             reg, data_high, data_low1, data_low2);
+  }
+};
+
+}  // namespace hwt905
+}  // namespace esphome
@@ -0,0 +1,72 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ACCELERATION_X,
+    CONF_ACCELERATION_Y,
+    CONF_ACCELERATION_Z,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_DEGREES,
+    UNIT_METER_PER_SECOND_SQUARED,
+)
+
+from . import CONF_HWT905_ID, HWT905Sensor, enable_vibration_monitor
+
+DEPENDENCIES = ["hwt905"]
+
+CONF_ELEVATION = "elevation"
+CONF_HEADING = "heading"
+CONF_VIBRATION_RMS = "vibration_rms"
+CONF_VIBRATION_PEAK_TO_PEAK = "vibration_peak_to_peak"
+
+
+def angle_schema(icon):
+    return sensor.sensor_schema(
+        unit_of_measurement=UNIT_DEGREES,
+        icon=icon,
+        accuracy_decimals=2,
+        state_class=STATE_CLASS_MEASUREMENT,
+    )
+
+
+def acceleration_schema(icon):
+    return sensor.sensor_schema(
+        unit_of_measurement=UNIT_METER_PER_SECOND_SQUARED,
+        icon=icon,
+        accuracy_decimals=3,
+        state_class=STATE_CLASS_MEASUREMENT,
+    )
+
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_HWT905_ID): cv.use_id(HWT905Sensor),
+        cv.Optional(CONF_ELEVATION): angle_schema("mdi:angle-acute"),
+        cv.Optional(CONF_HEADING): angle_schema("mdi:compass"),
+        cv.Optional(CONF_ACCELERATION_X): acceleration_schema("mdi:axis-x-arrow"),
+        cv.Optional(CONF_ACCELERATION_Y): acceleration_schema("mdi:axis-y-arrow"),
+        cv.Optional(CONF_ACCELERATION_Z): acceleration_schema("mdi:axis-z-arrow"),
+        cv.Optional(CONF_VIBRATION_RMS): acceleration_schema("mdi:vibrate"),
+        cv.Optional(CONF_VIBRATION_PEAK_TO_PEAK): acceleration_schema("mdi:waveform"),
+    }
+)
+
+
+async def to_code(config):
+    hub = await cg.get_variable(config[CONF_HWT905_ID])
+
+    if CONF_VIBRATION_RMS in config or CONF_VIBRATION_PEAK_TO_PEAK in config:
+        enable_vibration_monitor()
+
+    for key in (
+        CONF_ELEVATION,
+        CONF_HEADING,
+        CONF_ACCELERATION_X,
+        CONF_ACCELERATION_Y,
+        CONF_ACCELERATION_Z,
+        CONF_VIBRATION_RMS,
+        CONF_VIBRATION_PEAK_TO_PEAK,
+    ):
+        if key in config:
+            sens = await sensor.new_sensor(config[key])
+            cg.add(getattr(hub, f"set_{key}_sensor")(sens))
@@ -0,0 +1,342 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+import esphome.final_validate as fv
+from esphome import pins
+from esphome.components.hwt905 import (
+    CONF_HWT905_ID,
+    CONF_VIBRATION_WINDOW_SIZE,
+    HWT905_OUTPUT_RATE_HZ,
+    HWT905Sensor,
+    enable_vibration_monitor,
+)
+from esphome.const import CONF_ID, CONF_INVERTED, CONF_NUMBER
+
+DEPENDENCIES = ["hwt905"]
+
+CONF_ELEVATION = "elevation"
+CONF_AZIMUTH = "azimuth"
+CONF_FORWARD_PIN = "forward_pin"
+CONF_BACKWARD_PIN = "backward_pin"
+CONF_CW_PIN = "cw_pin"
+CONF_CCW_PIN = "ccw_pin"
+CONF_HOME_PIN = "home_pin"
+CONF_TOLERANCE = "tolerance"
+CONF_SPEED = "speed"
+CONF_READ_INTERVAL = "read_interval"
+CONF_BURST_TIME = "burst_time"
+CONF_MOTOR_TIMEOUT = "motor_timeout"
+CONF_HOMING = "homing"
+CONF_TIMEOUT = "timeout"
+CONF_BACKOFF_TIME = "backoff_time"
+CONF_SLOW_APPROACH_TIME = "slow_approach_time"
+CONF_SETTLE_TIME = "settle_time"
+CONF_WIND_STOW = "wind_stow"
+CONF_RMS_THRESHOLD = "rms_threshold"
+CONF_PEAK_TO_PEAK_THRESHOLD = "peak_to_peak_threshold"
+CONF_RESUME_RMS_THRESHOLD = "resume_rms_threshold"
+CONF_RESUME_PEAK_TO_PEAK_THRESHOLD = "resume_peak_to_peak_threshold"
+CONF_TRIGGER_TIME = "trigger_time"
+CONF_RESUME_TIME = "resume_time"
+CONF_STOW_ELEVATION = "stow_elevation"
+CONF_MOVE_SCHEDULER = "move_scheduler"
+CONF_MERGE_WINDOW = "merge_window"
+CONF_RECHECK_INTERVAL = "recheck_interval"
+CONF_PANEL_POWER = "panel_power"
+CONF_GAIN_HORIZON = "gain_horizon"
+CONF_MIN_GAIN_RATIO = "min_gain_ratio"
+CONF_ELEVATION_MOTOR_POWER = "elevation_motor_power"
+CONF_AZIMUTH_MOTOR_POWER = "azimuth_motor_power"
+CONF_MOTOR_START_COST = "motor_start_cost"
+
+solar_tracker_ns = cg.esphome_ns.namespace("solar_tracker")
+SolarTrackerMotorController = solar_tracker_ns.class_(
+    "SolarTrackerMotorController", cg.Component
+)
+
+# Motor bursts and homing pulses use blocking delays inside loop()
+MAX_BLOCKING_TIME = cv.TimePeriod(milliseconds=1000)
+
+
+def blocking_time(value):
+    return cv.All(
+        cv.positive_time_period_milliseconds, cv.Range(max=MAX_BLOCKING_TIME)
+    )(value)
+
+
+def constexpr_pin(schema):
+    """Full pin schema, so ESPHome tracks pin usage, reduced to a plain GPIO."""
+
+    def validator(value):
+        value = schema(value)
+        if value[CONF_INVERTED]:
+            raise cv.Invalid("Inverted pins are not supported; swap the wiring instead")
+        return value
+
+    return validator
+
+
+OUTPUT_PIN_SCHEMA = constexpr_pin(pins.internal_gpio_output_pin_schema)
+HOME_PIN_SCHEMA = constexpr_pin(pins.internal_gpio_input_pullup_pin_schema)
+
+ELEVATION_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_FORWARD_PIN): OUTPUT_PIN_SCHEMA,
+        cv.Required(CONF_BACKWARD_PIN): OUTPUT_PIN_SCHEMA,
+        cv.Optional(CONF_TOLERANCE, default=0.5): cv.float_range(min=0.1, max=10.0),
+        # Initial degrees per second estimate; refined from measured moves
+        cv.Optional(CONF_SPEED, default=0.5): cv.float_range(min=0.01, max=20.0),
+    }
+)
+
+AZIMUTH_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_CW_PIN): OUTPUT_PIN_SCHEMA,
+        cv.Required(CONF_CCW_PIN): OUTPUT_PIN_SCHEMA,
+        cv.Required(CONF_HOME_PIN): HOME_PIN_SCHEMA,
+        cv.Optional(CONF_TOLERANCE, default=2.0): cv.float_range(min=0.1, max=20.0),
+        cv.Optional(CONF_SPEED, default=0.5): cv.float_range(min=0.01, max=20.0),
+        cv.Optional(
+            CONF_READ_INTERVAL, default="500ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_BURST_TIME, default="300ms"): blocking_time,
+    }
+)
+
+HOMING_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_TIMEOUT, default="180s"): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_BACKOFF_TIME, default="2s"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_SLOW_APPROACH_TIME, default="100ms"): blocking_time,
+        cv.Optional(
+            CONF_SETTLE_TIME, default="500ms"
+        ): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+def validate_wind_stow(config):
+    # Release thresholds below the trigger thresholds give the hysteresis band
+    if config[CONF_RESUME_RMS_THRESHOLD] >= config[CONF_RMS_THRESHOLD]:
+        raise cv.Invalid(
+            f"{CONF_RESUME_RMS_THRESHOLD} must be lower than {CONF_RMS_THRESHOLD}"
+        )
+    if (
+        config[CONF_RESUME_PEAK_TO_PEAK_THRESHOLD]
+        >= config[CONF_PEAK_TO_PEAK_THRESHOLD]
+    ):
+        raise cv.Invalid(
+            f"{CONF_RESUME_PEAK_TO_PEAK_THRESHOLD} must be lower than "
+            f"{CONF_PEAK_TO_PEAK_THRESHOLD}"
+        )
+    return config
+
+
+WIND_STOW_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_RMS_THRESHOLD, default=2.0): cv.positive_float,
+            cv.Optional(CONF_PEAK_TO_PEAK_THRESHOLD, default=8.0): cv.positive_float,
+            cv.Optional(CONF_RESUME_RMS_THRESHOLD, default=1.0): cv.positive_float,
+            cv.Optional(
+                CONF_RESUME_PEAK_TO_PEAK_THRESHOLD, default=4.0
+            ): cv.positive_float,
+            cv.Optional(
+                CONF_TRIGGER_TIME, default="500ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_RESUME_TIME, default="10min"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_STOW_ELEVATION, default=0.0): cv.float_range(
+                min=0.0, max=90.0
+            ),
+        }
+    ),
+    validate_wind_stow,
+)
+
+MOVE_SCHEDULER_SCHEMA = cv.Schema(
+    {
+        cv.Optional(
+            CONF_MERGE_WINDOW, default="5s"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_RECHECK_INTERVAL, default="60s"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_PANEL_POWER, default=400.0): cv.positive_float,
+        cv.Optional(
+            CONF_GAIN_HORIZON, default="15min"
+        ): cv.positive_time_period_seconds,
+        cv.Optional(CONF_MIN_GAIN_RATIO, default=1.0): cv.positive_float,
+        cv.Optional(CONF_ELEVATION_MOTOR_POWER, default=48.0): cv.positive_float,
+        cv.Optional(CONF_AZIMUTH_MOTOR_POWER, default=72.0): cv.positive_float,
+        cv.Optional(CONF_MOTOR_START_COST, default=5.0): cv.positive_float,
+    }
+)
+
+
+def validate_unique_pins(config):
+    used = [
+        config[CONF_ELEVATION][CONF_FORWARD_PIN][CONF_NUMBER],
+        config[CONF_ELEVATION][CONF_BACKWARD_PIN][CONF_NUMBER],
+        config[CONF_AZIMUTH][CONF_CW_PIN][CONF_NUMBER],
+        config[CONF_AZIMUTH][CONF_CCW_PIN][CONF_NUMBER],
+        config[CONF_AZIMUTH][CONF_HOME_PIN][CONF_NUMBER],
+    ]
+    if len(set(used)) != len(used):
+        raise cv.Invalid("Motor and home switch pins must all be different")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(SolarTrackerMotorController),
+            cv.GenerateID(CONF_HWT905_ID): cv.use_id(HWT905Sensor),
+            cv.Required(CONF_ELEVATION): ELEVATION_SCHEMA,
+            cv.Required(CONF_AZIMUTH): AZIMUTH_SCHEMA,
+            cv.Optional(
+                CONF_MOTOR_TIMEOUT, default="120s"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_HOMING, default={}): HOMING_SCHEMA,
+            cv.Optional(CONF_WIND_STOW): WIND_STOW_SCHEMA,
+            cv.Optional(CONF_MOVE_SCHEDULER): MOVE_SCHEDULER_SCHEMA,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    validate_unique_pins,
+)
+
+
+def final_validate_trigger_time(config):
+    # A single spike stays in the vibration window for its full length, so the
+    # sustained-vibration time must be longer than the window to filter it out
+    if CONF_WIND_STOW not in config:
+        return config
+    full_config = fv.full_config.get()
+    hub_path = full_config.get_path_for_id(config[CONF_HWT905_ID])[:-1]
+    hub = full_config.get_config_for_path(hub_path)
+    window_ms = hub[CONF_VIBRATION_WINDOW_SIZE] * 1000 // HWT905_OUTPUT_RATE_HZ
+    trigger_ms = config[CONF_WIND_STOW][CONF_TRIGGER_TIME].total_milliseconds
+    if trigger_ms <= window_ms:
+        raise cv.Invalid(
+            f"{CONF_TRIGGER_TIME} ({trigger_ms}ms) must be longer than the HWT905 "
+            f"vibration window ({window_ms}ms)",
+            path=[CONF_WIND_STOW, CONF_TRIGGER_TIME],
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = final_validate_trigger_time
+
+
+def _float(value):
+    return f"{float(value)}f"
+
+
+def _ms(value):
+    return f"{value.total_milliseconds}UL"
+
+
+def config_struct(name, config):
+    """Render the validated YAML as a struct of static constexpr members."""
+    elevation = config[CONF_ELEVATION]
+    azimuth = config[CONF_AZIMUTH]
+    homing = config[CONF_HOMING]
+    fields = [
+        ("int", "ELEVATION_FORWARD_PIN", elevation[CONF_FORWARD_PIN][CONF_NUMBER]),
+        ("int", "ELEVATION_BACKWARD_PIN", elevation[CONF_BACKWARD_PIN][CONF_NUMBER]),
+        ("int", "AZIMUTH_CW_PIN", azimuth[CONF_CW_PIN][CONF_NUMBER]),
+        ("int", "AZIMUTH_CCW_PIN", azimuth[CONF_CCW_PIN][CONF_NUMBER]),
+        ("int", "HOME_SWITCH_PIN", azimuth[CONF_HOME_PIN][CONF_NUMBER]),
+        ("float", "ELEVATION_TOLERANCE", _float(elevation[CONF_TOLERANCE])),
+        ("float", "AZIMUTH_TOLERANCE", _float(azimuth[CONF_TOLERANCE])),
+        ("float", "ELEVATION_RATE", _float(elevation[CONF_SPEED])),
+        ("float", "AZIMUTH_RATE", _float(azimuth[CONF_SPEED])),
+        ("uint32_t", "MOTOR_TIMEOUT", _ms(config[CONF_MOTOR_TIMEOUT])),
+        ("uint32_t", "AZIMUTH_READ_INTERVAL", _ms(azimuth[CONF_READ_INTERVAL])),
+        ("uint32_t", "AZIMUTH_BURST_TIME", _ms(azimuth[CONF_BURST_TIME])),
+        ("uint32_t", "HOMING_TIMEOUT", _ms(homing[CONF_TIMEOUT])),
+        ("uint32_t", "HOMING_BACKOFF_TIME", _ms(homing[CONF_BACKOFF_TIME])),
+        (
+            "uint32_t",
+            "HOMING_SLOW_APPROACH_TIME",
+            _ms(homing[CONF_SLOW_APPROACH_TIME]),
+        ),
+        ("uint32_t", "HOMING_SETTLE_TIME", _ms(homing[CONF_SETTLE_TIME])),
+    ]
+
+    if CONF_WIND_STOW in config:
+        wind = config[CONF_WIND_STOW]
+        fields += [
+            ("float", "WIND_STOW_RMS_THRESHOLD", _float(wind[CONF_RMS_THRESHOLD])),
+            (
+                "float",
+                "WIND_STOW_P2P_THRESHOLD",
+                _float(wind[CONF_PEAK_TO_PEAK_THRESHOLD]),
+            ),
+            (
+                "float",
+                "WIND_RESUME_RMS_THRESHOLD",
+                _float(wind[CONF_RESUME_RMS_THRESHOLD]),
+            ),
+            (
+                "float",
+                "WIND_RESUME_P2P_THRESHOLD",
+                _float(wind[CONF_RESUME_PEAK_TO_PEAK_THRESHOLD]),
+            ),
+            ("uint32_t", "WIND_STOW_TRIGGER_TIME", _ms(wind[CONF_TRIGGER_TIME])),
+            ("uint32_t", "WIND_RESUME_CALM_TIME", _ms(wind[CONF_RESUME_TIME])),
+            ("float", "WIND_STOW_ELEVATION", _float(wind[CONF_STOW_ELEVATION])),
+        ]
+
+    if CONF_MOVE_SCHEDULER in config:
+        sched = config[CONF_MOVE_SCHEDULER]
+        fields += [
+            ("uint32_t", "MOVE_MERGE_WINDOW", _ms(sched[CONF_MERGE_WINDOW])),
+            (
+                "uint32_t",
+                "MOVE_RECHECK_INTERVAL",
+                _ms(sched[CONF_RECHECK_INTERVAL]),
+            ),
+            ("float", "PANEL_POWER_W", _float(sched[CONF_PANEL_POWER])),
+            (
+                "float",
+                "MOVE_GAIN_HORIZON",
+                _float(sched[CONF_GAIN_HORIZON].total_seconds),
+            ),
+            ("float", "MOVE_MIN_GAIN_RATIO", _float(sched[CONF_MIN_GAIN_RATIO])),
+            (
+                "float",
+                "ELEVATION_MOTOR_POWER_W",
+                _float(sched[CONF_ELEVATION_MOTOR_POWER]),
+            ),
+            (
+                "float",
+                "AZIMUTH_MOTOR_POWER_W",
+                _float(sched[CONF_AZIMUTH_MOTOR_POWER]),
+            ),
+            ("float", "MOTOR_START_COST_J", _float(sched[CONF_MOTOR_START_COST])),
+        ]
+
+    lines = [f"struct {name} {{"]
+    lines += [f"  static constexpr {t} {key} = {value};" for t, key, value in fields]
+    lines.append("};")
+    return "\n".join(lines)
+
+
+async def to_code(config):
+    if CONF_WIND_STOW in config:
+        enable_vibration_monitor()
+        cg.add_define("USE_SOLAR_TRACKER_WIND_STOW")
+    if CONF_MOVE_SCHEDULER in config:
+        cg.add_define("USE_SOLAR_TRACKER_MOVE_SCHEDULER")
+
+    struct_name = f"{config[CONF_ID].id}_config_t"
+    cg.add_global(cg.RawStatement(config_struct(struct_name, config)))
+
+    hwt905 = await cg.get_variable(config[CONF_HWT905_ID])
+    var = cg.new_Pvariable(
+        config[CONF_ID], cg.TemplateArguments(cg.RawExpression(struct_name)), hwt905
+    )
+    await cg.register_component(var, config)
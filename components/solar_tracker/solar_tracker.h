@@ -0,0 +1,975 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include <driver/gpio.h>
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/components/hwt905/hwt905.h"
+
+namespace esphome {
+namespace solar_tracker {
+
+/**
+ * Motor Controller for Solar Tracker
+ * Controls elevation (linear actuator) and azimuth (slewing drive)
+ * Uses H-bridge drivers connected to GPIO pins
+ *
+ * Config is a struct of static constexpr pins, tolerances and timings that
+ * the solar_tracker codegen emits from the validated YAML, so the compiler
+ * can fold every control constant into the code
+ */
+template<typename Config> class SolarTrackerMotorController : public Component {
+ public:
+  explicit SolarTrackerMotorController(hwt905::HWT905Sensor *hwt905) : hwt905_(hwt905) {}
+
+  void setup() override {
+    ESP_LOGCONFIG("MotorController", "Setting up motor controller...");
+    
+    // Configure GPIO pins
+    setup_output_pin(Config::ELEVATION_FORWARD_PIN);
+    setup_output_pin(Config::ELEVATION_BACKWARD_PIN);
+    setup_output_pin(Config::AZIMUTH_CW_PIN);
+    setup_output_pin(Config::AZIMUTH_CCW_PIN);
+    gpio_reset_pin(gpio_pin(Config::HOME_SWITCH_PIN));
+    gpio_set_direction(gpio_pin(Config::HOME_SWITCH_PIN), GPIO_MODE_INPUT);
+    gpio_set_pull_mode(gpio_pin(Config::HOME_SWITCH_PIN), GPIO_PULLUP_ONLY);
+    
+    // Ensure all motors are stopped
+    stop_all_motors();
+    
+    ESP_LOGCONFIG("MotorController", "Motor controller initialized");
+  }
+
+  void loop() override {
+#ifdef USE_SOLAR_TRACKER_WIND_STOW
+    // Wind/vibration stow takes priority over normal movement
+    check_wind_stow();
+#endif
+    
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+    // Dispatch or defer queued moves once the merge window has passed
+    update_move_scheduler();
+#endif
+    
+    // Handle homing sequence
+    if (homing_active_) {
+      update_homing_sequence();
+    }
+    
+    // Handle elevation movement
+    if (elevation_active_) {
+      update_elevation_movement();
+    }
+    
+    // Handle azimuth movement
+    if (azimuth_active_) {
+      update_azimuth_movement();
+    }
+    
+    // Safety timeout check
+    check_safety_timeout();
+    
+    update_tracking_statistics();
+  }
+
+  /**
+   * Set elevation angle
+   * Runs linear actuator until target angle is reached, unless the move
+   * scheduler decides the pointing gain is not worth the motor energy yet.
+   * A flat (0°) target is a stow and always moves immediately
+   */
+  void set_elevation(float target_angle) {
+    command_elevation(target_angle, target_angle <= 0.0f);
+  }
+
+  /**
+   * Move elevation to a protective position (wind, ice, night, low battery)
+   * Bypasses the move scheduler - the pointing gain/cost check does not apply
+   */
+  void stow(float target_angle) {
+    ESP_LOGI("MotorController", "Stow to %.2f° requested", target_angle);
+    command_elevation(target_angle, true);
+  }
+
+  /**
+   * Set azimuth/heading angle
+   * Runs slewing drive until target heading is reached
+   */
+  void set_azimuth(float target_angle) {
+    if (emergency_stop_active_) {
+      ESP_LOGW("MotorController", "Emergency stop active - ignoring azimuth command");
+      return;
+    }
+    
+    if (!azimuth_homed_) {
+      ESP_LOGW("MotorController", "Azimuth not homed - please run home_azimuth() first");
+      return;
+    }
+    
+    // Normalize to 0-360
+    while (target_angle < 0) target_angle += 360.0;
+    while (target_angle >= 360.0) target_angle -= 360.0;
+    
+#ifdef USE_SOLAR_TRACKER_WIND_STOW
+    if (wind_stow_active_) {
+      resume_azimuth_ = target_angle;
+      resume_azimuth_valid_ = true;
+      ESP_LOGW("MotorController", "Wind stow active - azimuth %.2f° deferred", resume_azimuth_);
+      return;
+    }
+#endif
+    
+    requested_azimuth_ = target_angle;
+    has_requested_azimuth_ = true;
+    
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+    if (move_scheduler_enabled_ && !azimuth_active_) {
+      queue_move();
+      return;
+    }
+#endif
+    
+    start_azimuth_move(requested_azimuth_);
+  }
+
+  /**
+   * Home the azimuth axis
+   * Rotates CCW until home switch is triggered, then sets that position as 0°
+   */
+  void home_azimuth() {
+    if (emergency_stop_active_) {
+      ESP_LOGW("MotorController", "Emergency stop active - ignoring homing command");
+      return;
+    }
+    
+    if (wind_stow_active_) {
+      ESP_LOGW("MotorController", "Wind stow active - ignoring homing command");
+      return;
+    }
+    
+    ESP_LOGI("MotorController", "Starting azimuth homing sequence...");
+    
+    // Homing owns the azimuth motor; drop any running or queued azimuth move
+    // (a target from before homing refers to the old zero anyway)
+    if (azimuth_active_) {
+      stop_azimuth_motor();
+      azimuth_active_ = false;
+    }
+    has_requested_azimuth_ = false;
+    
+    homing_active_ = true;
+    homing_phase_ = HOMING_MOVE_OFF_SWITCH;
+    homing_start_time_ = millis();
+    azimuth_homed_ = false;
+    
+    // If already on switch, back off first
+    if (is_home_switch_pressed()) {
+      ESP_LOGD("MotorController", "Already on home switch, backing off...");
+      homing_phase_ = HOMING_MOVE_OFF_SWITCH;
+    } else {
+      ESP_LOGD("MotorController", "Moving to home switch...");
+      homing_phase_ = HOMING_SEEK_SWITCH;
+    }
+  }
+
+  void stop_all_motors() {
+    stop_elevation_motor();
+    stop_azimuth_motor();
+    
+    elevation_active_ = false;
+    azimuth_active_ = false;
+    homing_active_ = false;
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+    move_pending_ = false;
+#endif
+    
+    ESP_LOGI("MotorController", "All motors stopped");
+  }
+
+  void emergency_stop() {
+    emergency_stop_active_ = true;
+    stop_all_motors();
+    
+    ESP_LOGW("MotorController", "EMERGENCY STOP ACTIVATED");
+  }
+
+  void reset_emergency_stop() {
+    emergency_stop_active_ = false;
+    ESP_LOGI("MotorController", "Emergency stop reset");
+  }
+
+  bool is_wind_stow_active() {
+    return wind_stow_active_;
+  }
+
+  /**
+   * Enable/disable the energy-aware move scheduler
+   * When disabled every command moves immediately (old behaviour)
+   * Always declared so YAML services compile without move_scheduler:
+   */
+  void set_move_scheduler_enabled(bool enabled) {
+#ifndef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+    (void) enabled;
+    ESP_LOGW("MotorController", "Move scheduler not configured - ignoring %s request",
+             enabled ? "enable" : "disable");
+#else
+    move_scheduler_enabled_ = enabled;
+    if (!enabled && move_pending_) {
+      // Flush whatever was being held back
+      move_pending_ = false;
+      if (has_requested_azimuth_ && is_azimuth_ready()) start_azimuth_move(requested_azimuth_);
+      if (has_requested_elevation_) start_elevation_move(requested_elevation_);
+    }
+    ESP_LOGI("MotorController", "Move scheduler %s", enabled ? "enabled" : "disabled");
+#endif
+  }
+
+  // Total motor on-time for both axes, including a run in progress (seconds)
+  float get_motor_on_time() {
+    return (elevation_on_time_now() + azimuth_on_time_now()) / 1000.0;
+  }
+
+  // Per-axis motor on-time as a percentage of uptime (the axes can run together,
+  // so a combined figure could exceed 100%)
+  float get_elevation_motor_duty() {
+    return duty_percent(elevation_on_time_now());
+  }
+
+  float get_azimuth_motor_duty() {
+    return duty_percent(azimuth_on_time_now());
+  }
+
+  // Time-averaged cosine of the pointing error while the sun is up (%)
+  float get_tracking_efficiency() {
+    if (efficiency_samples_ == 0) return 100.0;
+    return 100.0 * efficiency_sum_ / efficiency_samples_;
+  }
+
+  uint32_t get_motor_starts() {
+    return motor_starts_;
+  }
+
+  uint32_t get_moves_deferred() {
+    return moves_deferred_;
+  }
+
+ private:
+  hwt905::HWT905Sensor *hwt905_;
+  
+  // Target angles
+  float target_elevation_ = 0.0;
+  float target_azimuth_ = 0.0;
+  float azimuth_home_offset_ = 0.0;  // Offset to apply after homing
+  
+  // State flags
+  bool elevation_active_ = false;
+  bool azimuth_active_ = false;
+  bool emergency_stop_active_ = false;
+  bool homing_active_ = false;
+  bool azimuth_homed_ = false;
+  bool wind_stow_active_ = false;
+  
+#ifdef USE_SOLAR_TRACKER_WIND_STOW
+  // Targets to restore once the wind stow is released
+  float resume_elevation_ = 0.0;
+  float resume_azimuth_ = 0.0;
+  bool resume_elevation_valid_ = false;
+  bool resume_azimuth_valid_ = false;
+  unsigned long vibration_high_since_ = 0;
+  unsigned long vibration_calm_since_ = 0;
+#endif
+  
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+  bool move_scheduler_enabled_ = true;
+  bool move_pending_ = false;
+  bool move_deferred_ = false;
+  unsigned long move_pending_since_ = 0;
+  unsigned long move_wait_ = 0;
+#endif
+  
+  // Latest requested (sun) position
+  float requested_elevation_ = 0.0;
+  float requested_azimuth_ = 0.0;
+  bool has_requested_elevation_ = false;
+  bool has_requested_azimuth_ = false;
+  
+  // Learned axis speeds (degrees per second of motor on-time)
+  float elevation_rate_ = Config::ELEVATION_RATE;
+  float azimuth_rate_ = Config::AZIMUTH_RATE;
+  float elevation_move_start_angle_ = 0.0;
+  float azimuth_move_start_angle_ = 0.0;
+  uint64_t elevation_move_start_on_time_ = 0;
+  uint64_t azimuth_move_start_on_time_ = 0;
+  bool elevation_move_retargeted_ = false;
+  bool azimuth_move_retargeted_ = false;
+  
+  // Motor usage and tracking statistics
+  bool elevation_motor_running_ = false;
+  bool azimuth_motor_running_ = false;
+  uint64_t elevation_on_time_ms_ = 0;
+  uint64_t azimuth_on_time_ms_ = 0;
+  uint64_t uptime_ms_ = 0;
+  uint32_t motor_starts_ = 0;
+  uint32_t moves_deferred_ = 0;
+  float efficiency_sum_ = 0.0;
+  uint32_t efficiency_samples_ = 0;
+  
+  // Homing phases
+  enum HomingPhase {
+    HOMING_MOVE_OFF_SWITCH,
+    HOMING_SEEK_SWITCH,
+    HOMING_SLOW_APPROACH,
+    HOMING_SET_ZERO,
+    HOMING_COMPLETE
+  };
+  HomingPhase homing_phase_ = HOMING_MOVE_OFF_SWITCH;
+  
+  // Timing
+  unsigned long elevation_start_time_ = 0;
+  unsigned long azimuth_start_time_ = 0;
+  unsigned long azimuth_last_read_time_ = 0;
+  unsigned long homing_start_time_ = 0;
+  unsigned long homing_phase_start_ = 0;
+  unsigned long elevation_motor_on_since_ = 0;
+  unsigned long azimuth_motor_on_since_ = 0;
+  unsigned long last_stats_time_ = 0;
+  unsigned long last_efficiency_sample_ = 0;
+  
+  // Constants - folded from the YAML configuration at compile time
+  static constexpr float ELEVATION_TOLERANCE = Config::ELEVATION_TOLERANCE;  // degrees
+  static constexpr float AZIMUTH_TOLERANCE = Config::AZIMUTH_TOLERANCE;  // degrees
+  static constexpr uint32_t MOTOR_TIMEOUT = Config::MOTOR_TIMEOUT;  // Max motor runtime per move
+  static constexpr uint32_t AZIMUTH_READ_INTERVAL = Config::AZIMUTH_READ_INTERVAL;  // Heading check interval
+  static constexpr uint32_t AZIMUTH_BURST_TIME = Config::AZIMUTH_BURST_TIME;  // Azimuth motor pulse length
+  static constexpr uint32_t HOMING_TIMEOUT = Config::HOMING_TIMEOUT;  // Total homing time
+  static constexpr uint32_t HOMING_BACKOFF_TIME = Config::HOMING_BACKOFF_TIME;  // Time to move off switch
+  static constexpr uint32_t HOMING_SLOW_APPROACH_TIME = Config::HOMING_SLOW_APPROACH_TIME;  // Slow approach pulses
+  static constexpr uint32_t HOMING_SETTLE_TIME = Config::HOMING_SETTLE_TIME;  // Wait time after finding home
+#ifdef USE_SOLAR_TRACKER_WIND_STOW
+  static constexpr float WIND_STOW_RMS_THRESHOLD = Config::WIND_STOW_RMS_THRESHOLD;  // m/s² RMS to trigger stow
+  static constexpr float WIND_STOW_P2P_THRESHOLD = Config::WIND_STOW_P2P_THRESHOLD;  // m/s² peak-to-peak to trigger stow
+  static constexpr float WIND_RESUME_RMS_THRESHOLD = Config::WIND_RESUME_RMS_THRESHOLD;  // m/s² RMS counted as calm
+  static constexpr float WIND_RESUME_P2P_THRESHOLD = Config::WIND_RESUME_P2P_THRESHOLD;  // m/s² peak-to-peak counted as calm
+  static constexpr uint32_t WIND_STOW_TRIGGER_TIME = Config::WIND_STOW_TRIGGER_TIME;  // Sustained vibration time
+  static constexpr uint32_t WIND_RESUME_CALM_TIME = Config::WIND_RESUME_CALM_TIME;  // Calm time before resuming
+  static constexpr float WIND_STOW_ELEVATION = Config::WIND_STOW_ELEVATION;  // Stow position
+#endif
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+  static constexpr uint32_t MOVE_MERGE_WINDOW = Config::MOVE_MERGE_WINDOW;  // Wait for the other axis command
+  static constexpr uint32_t MOVE_RECHECK_INTERVAL = Config::MOVE_RECHECK_INTERVAL;  // Re-evaluate deferred moves
+  static constexpr float PANEL_POWER_W = Config::PANEL_POWER_W;  // Rated array output used to value pointing gain
+  static constexpr float MOVE_GAIN_HORIZON = Config::MOVE_GAIN_HORIZON;  // Seconds a correction pays off for
+  static constexpr float MOVE_MIN_GAIN_RATIO = Config::MOVE_MIN_GAIN_RATIO;  // Energy gained per energy spent
+  static constexpr float ELEVATION_MOTOR_POWER_W = Config::ELEVATION_MOTOR_POWER_W;  // Linear actuator draw
+  static constexpr float AZIMUTH_MOTOR_POWER_W = Config::AZIMUTH_MOTOR_POWER_W;  // Slewing drive draw
+  static constexpr float MOTOR_START_COST_J = Config::MOTOR_START_COST_J;  // Inrush plus wear per start
+#endif
+  static constexpr float RATE_LEARNING_ALPHA = 0.2;  // Smoothing for learned axis speeds
+  static constexpr uint32_t RATE_MIN_SAMPLE_MS = 1000;  // Ignore moves too short to measure speed
+  static constexpr uint32_t EFFICIENCY_SAMPLE_INTERVAL = 1000;  // Tracking efficiency sample period
+  static constexpr float DEGREES_TO_RADIANS = M_PI / 180.0;
+
+#ifdef USE_SOLAR_TRACKER_WIND_STOW
+  /**
+   * Stow on sustained vibration and resume after a calm period
+   * Separate trigger/release thresholds plus dwell times give hysteresis
+   */
+  void check_wind_stow() {
+    if (!hwt905_->is_vibration_valid()) {
+      return;
+    }
+    
+    float rms = hwt905_->get_vibration_rms();
+    float p2p = hwt905_->get_vibration_peak_to_peak();
+    unsigned long now = millis();
+    
+    if (!wind_stow_active_) {
+      if (rms < WIND_STOW_RMS_THRESHOLD && p2p < WIND_STOW_P2P_THRESHOLD) {
+        vibration_high_since_ = 0;
+        return;
+      }
+      
+      if (vibration_high_since_ == 0) {
+        vibration_high_since_ = now;
+      }
+      
+      if (now - vibration_high_since_ >= WIND_STOW_TRIGGER_TIME && !emergency_stop_active_) {
+        ESP_LOGW("MotorController", "High vibration (RMS=%.2f, P2P=%.2f m/s²) - wind stow", rms, p2p);
+        start_wind_stow();
+      }
+      return;
+    }
+    
+    if (rms > WIND_RESUME_RMS_THRESHOLD || p2p > WIND_RESUME_P2P_THRESHOLD) {
+      vibration_calm_since_ = 0;
+      return;
+    }
+    
+    if (vibration_calm_since_ == 0) {
+      vibration_calm_since_ = now;
+    }
+    
+    if (now - vibration_calm_since_ >= WIND_RESUME_CALM_TIME) {
+      ESP_LOGI("MotorController", "Vibration calm for %lus - resuming tracking",
+               (unsigned long) (WIND_RESUME_CALM_TIME / 1000));
+      end_wind_stow();
+    }
+  }
+
+  void start_wind_stow() {
+    // Resume at the latest requested position (which may still be deferred by
+    // the move scheduler), falling back to the last executed move
+    resume_elevation_ = has_requested_elevation_ ? requested_elevation_ : target_elevation_;
+    resume_elevation_valid_ = true;
+    resume_azimuth_ = has_requested_azimuth_ ? requested_azimuth_ : target_azimuth_;
+    // A homing run in progress is left to finish, so azimuth is referenced on resume
+    resume_azimuth_valid_ = azimuth_homed_ || homing_active_;
+    
+    // The stow only drives elevation; stop tracking moves but not homing
+    stop_elevation_motor();
+    elevation_active_ = false;
+    if (!homing_active_) {
+      stop_azimuth_motor();
+    }
+    azimuth_active_ = false;
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+    move_pending_ = false;
+#endif
+    
+    wind_stow_active_ = true;
+    vibration_high_since_ = 0;
+    vibration_calm_since_ = 0;
+    
+    start_elevation_move(WIND_STOW_ELEVATION);
+  }
+
+  void end_wind_stow() {
+    wind_stow_active_ = false;
+    vibration_calm_since_ = 0;
+    
+    if (emergency_stop_active_) {
+      return;
+    }
+    
+    if (resume_azimuth_valid_) {
+      set_azimuth(resume_azimuth_);
+    }
+    if (resume_elevation_valid_) {
+      set_elevation(resume_elevation_);
+    }
+  }
+#endif
+
+  // Shared by set_elevation() and stow(); immediate skips the move scheduler
+  void command_elevation(float target_angle, bool immediate) {
+    if (emergency_stop_active_) {
+      ESP_LOGW("MotorController", "Emergency stop active - ignoring elevation command");
+      return;
+    }
+    
+#ifdef USE_SOLAR_TRACKER_WIND_STOW
+    if (wind_stow_active_) {
+      // Remember the request so tracking picks up from it on resume
+      resume_elevation_ = std::clamp(target_angle, 0.0f, 90.0f);
+      resume_elevation_valid_ = true;
+      ESP_LOGW("MotorController", "Wind stow active - elevation %.2f° deferred", resume_elevation_);
+      return;
+    }
+#endif
+    
+    requested_elevation_ = std::clamp(target_angle, 0.0f, 90.0f);
+    has_requested_elevation_ = true;
+    
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+    // If already moving, retarget the running move instead of queueing another
+    if (move_scheduler_enabled_ && !elevation_active_ && !immediate) {
+      queue_move();
+      return;
+    }
+#else
+    (void) immediate;
+#endif
+    
+    start_elevation_move(requested_elevation_);
+  }
+
+  void start_elevation_move(float target_angle) {
+    if (!elevation_active_) {
+      elevation_start_time_ = millis();
+      elevation_move_start_angle_ = hwt905_->get_current_elevation();
+      elevation_move_start_on_time_ = elevation_on_time_ms_;
+      elevation_move_retargeted_ = false;
+    } else {
+      // Travel no longer matches on-time (may even reverse), so don't learn from it
+      elevation_move_retargeted_ = true;
+    }
+    
+    target_elevation_ = target_angle;
+    elevation_active_ = true;
+    
+    ESP_LOGI("MotorController", "Setting elevation to %.2f°", target_elevation_);
+  }
+
+  void start_azimuth_move(float target_angle) {
+    if (!azimuth_active_) {
+      azimuth_start_time_ = millis();
+      azimuth_last_read_time_ = millis();
+      azimuth_move_start_angle_ = get_corrected_azimuth();
+      azimuth_move_start_on_time_ = azimuth_on_time_ms_;
+      azimuth_move_retargeted_ = false;
+    } else {
+      azimuth_move_retargeted_ = true;
+    }
+    
+    target_azimuth_ = target_angle;
+    azimuth_active_ = true;
+    
+    ESP_LOGI("MotorController", "Setting azimuth to %.2f°", target_azimuth_);
+  }
+
+#ifdef USE_SOLAR_TRACKER_MOVE_SCHEDULER
+  void queue_move() {
+    // Elevation and azimuth commands arrive separately; (re)start the merge
+    // window so both are evaluated as one move against the latest targets
+    move_pending_ = true;
+    move_deferred_ = false;
+    move_pending_since_ = millis();
+    move_wait_ = MOVE_MERGE_WINDOW;
+  }
+
+  /**
+   * Decide whether the queued move buys enough pointing gain
+   * Gain: cosine loss recovered, valued at panel power over the horizon
+   * Cost: estimated motor energy from learned speeds plus per-start wear
+   */
+  void update_move_scheduler() {
+    if (!move_pending_ || millis() - move_pending_since_ < move_wait_) {
+      return;
+    }
+    
+    float current_elevation = hwt905_->get_current_elevation();
+    float current_azimuth = get_corrected_azimuth();
+    float target_elevation = has_requested_elevation_ ? requested_elevation_ : current_elevation;
+    // A queued azimuth target waits while homing runs (or if it never completed)
+    float target_azimuth = has_requested_azimuth_ && is_azimuth_ready() ? requested_azimuth_ : current_azimuth;
+    
+    float elevation_error = fabsf(target_elevation - current_elevation);
+    float azimuth_error = fabsf(calculate_azimuth_error(current_azimuth, target_azimuth));
+    // An axis that is already moving (e.g. a stow) was retargeted directly
+    bool move_elevation = !elevation_active_ && elevation_error >= ELEVATION_TOLERANCE;
+    bool move_azimuth = !azimuth_active_ && azimuth_error >= AZIMUTH_TOLERANCE;
+    
+    if (!move_elevation && !move_azimuth) {
+      move_pending_ = false;
+      return;
+    }
+    
+    float loss = 1.0 - pointing_cosine(current_elevation, current_azimuth, target_elevation, target_azimuth);
+    float gain = PANEL_POWER_W * loss * MOVE_GAIN_HORIZON;
+    float cost = estimate_move_cost(move_elevation ? elevation_error : 0.0,
+                                    move_azimuth ? azimuth_error : 0.0);
+    
+    if (gain < MOVE_MIN_GAIN_RATIO * cost) {
+      // Keep the request and look again later - the loss grows as the sun moves
+      if (!move_deferred_) {
+        moves_deferred_++;
+        move_deferred_ = true;
+      }
+      move_pending_since_ = millis();
+      move_wait_ = MOVE_RECHECK_INTERVAL;
+      ESP_LOGD("MotorController", "Move deferred: gain %.0fJ < cost %.0fJ (loss %.3f%%)",
+               gain, cost, loss * 100.0);
+      return;
+    }
+    
+    move_pending_ = false;
+    ESP_LOGD("MotorController", "Move scheduled: gain %.0fJ, cost %.0fJ", gain, cost);
+    if (move_azimuth) {
+      start_azimuth_move(target_azimuth);
+    }
+    if (move_elevation) {
+      start_elevation_move(target_elevation);
+    }
+  }
+
+  float estimate_move_cost(float elevation_degrees, float azimuth_degrees) {
+    float cost = 0.0;
+    
+    if (elevation_degrees > 0) {
+      float seconds = elevation_degrees / elevation_rate_;
+      cost += seconds * ELEVATION_MOTOR_POWER_W + MOTOR_START_COST_J;
+    }
+    
+    if (azimuth_degrees > 0) {
+      // Azimuth runs in bursts, so every burst is a motor start
+      float seconds = azimuth_degrees / azimuth_rate_;
+      float bursts = ceilf(seconds * 1000.0 / AZIMUTH_BURST_TIME);
+      cost += seconds * AZIMUTH_MOTOR_POWER_W + bursts * MOTOR_START_COST_J;
+    }
+    
+    return cost;
+  }
+#endif
+
+  // Cosine of the angle between two pointing directions (elevation/azimuth in degrees)
+  float pointing_cosine(float elev1, float azi1, float elev2, float azi2) {
+    float e1 = elev1 * DEGREES_TO_RADIANS;
+    float e2 = elev2 * DEGREES_TO_RADIANS;
+    float da = (azi2 - azi1) * DEGREES_TO_RADIANS;
+    float c = sinf(e1) * sinf(e2) + cosf(e1) * cosf(e2) * cosf(da);
+    return std::clamp(c, -1.0f, 1.0f);
+  }
+
+  // Accumulated on-time plus the current interval of a motor that is still running
+  uint64_t elevation_on_time_now() {
+    return elevation_on_time_ms_ + (elevation_motor_running_ ? millis() - elevation_motor_on_since_ : 0);
+  }
+
+  uint64_t azimuth_on_time_now() {
+    return azimuth_on_time_ms_ + (azimuth_motor_running_ ? millis() - azimuth_motor_on_since_ : 0);
+  }
+
+  float duty_percent(uint64_t on_time_ms) {
+    uint64_t uptime = uptime_ms_ + (millis() - last_stats_time_);
+    if (uptime == 0) return 0.0;
+    return std::min(100.0f, 100.0f * on_time_ms / uptime);
+  }
+
+  // Fold the measured speed of a finished move into the learned axis rate
+  void learn_axis_rate(float &rate, float degrees, uint64_t on_time_ms) {
+    if (on_time_ms < RATE_MIN_SAMPLE_MS || degrees <= 0) {
+      return;
+    }
+    float measured = degrees / (on_time_ms / 1000.0);
+    rate = RATE_LEARNING_ALPHA * measured + (1.0 - RATE_LEARNING_ALPHA) * rate;
+    ESP_LOGD("MotorController", "Measured %.3f°/s, learned rate now %.3f°/s", measured, rate);
+  }
+
+  void update_tracking_statistics() {
+    unsigned long now = millis();
+    uptime_ms_ += now - last_stats_time_;
+    last_stats_time_ = now;
+    
+    if (now - last_efficiency_sample_ < EFFICIENCY_SAMPLE_INTERVAL) {
+      return;
+    }
+    last_efficiency_sample_ = now;
+    
+    // Only count daylight tracking - a requested elevation of 0 means stowed/night
+    if (!has_requested_elevation_ || requested_elevation_ <= 0.0) {
+      return;
+    }
+    
+    float current_azimuth = get_corrected_azimuth();
+    float target_azimuth = has_requested_azimuth_ ? requested_azimuth_ : current_azimuth;
+    efficiency_sum_ += pointing_cosine(hwt905_->get_current_elevation(), current_azimuth,
+                                       requested_elevation_, target_azimuth);
+    efficiency_samples_++;
+  }
+
+  void update_elevation_movement() {
+    float current_elevation = hwt905_->get_current_elevation();
+    float error = target_elevation_ - current_elevation;
+    
+    ESP_LOGV("MotorController", "Elevation: Current=%.2f°, Target=%.2f°, Error=%.2f°", 
+             current_elevation, target_elevation_, error);
+    
+    if (fabsf(error) < ELEVATION_TOLERANCE) {
+      // Target reached
+      stop_elevation_motor();
+      elevation_active_ = false;
+      ESP_LOGI("MotorController", "Elevation target reached: %.2f°", current_elevation);
+      if (!elevation_move_retargeted_) {
+        learn_axis_rate(elevation_rate_, fabsf(current_elevation - elevation_move_start_angle_),
+                        elevation_on_time_ms_ - elevation_move_start_on_time_);
+      }
+    } else if (error > 0) {
+      // Need to move forward (increase angle)
+      run_elevation_forward();
+    } else {
+      // Need to move backward (decrease angle)
+      run_elevation_backward();
+    }
+  }
+
+  void update_azimuth_movement() {
+    // Check if it's time to read heading and adjust
+    if (millis() - azimuth_last_read_time_ < AZIMUTH_READ_INTERVAL) {
+      return;
+    }
+    
+    azimuth_last_read_time_ = millis();
+    
+    float current_azimuth = get_corrected_azimuth();
+    float error = calculate_azimuth_error(current_azimuth, target_azimuth_);
+    
+    ESP_LOGV("MotorController", "Azimuth: Current=%.2f°, Target=%.2f°, Error=%.2f°", 
+             current_azimuth, target_azimuth_, error);
+    
+    if (fabsf(error) < AZIMUTH_TOLERANCE) {
+      // Target reached
+      stop_azimuth_motor();
+      azimuth_active_ = false;
+      ESP_LOGI("MotorController", "Azimuth target reached: %.2f°", current_azimuth);
+      if (!azimuth_move_retargeted_) {
+        learn_axis_rate(azimuth_rate_, fabsf(calculate_azimuth_error(azimuth_move_start_angle_, current_azimuth)),
+                        azimuth_on_time_ms_ - azimuth_move_start_on_time_);
+      }
+    } else {
+      // Run motor in burst mode
+      if (error > 0) {
+        // Need to rotate clockwise
+        run_azimuth_burst_cw();
+      } else {
+        // Need to rotate counter-clockwise
+        run_azimuth_burst_ccw();
+      }
+    }
+  }
+
+  float calculate_azimuth_error(float current, float target) {
+    // Calculate shortest path error considering 0/360 wraparound
+    float error = target - current;
+    
+    if (error > 180.0) {
+      error -= 360.0;
+    } else if (error < -180.0) {
+      error += 360.0;
+    }
+    
+    return error;
+  }
+
+  void update_homing_sequence() {
+    // Check for timeout
+    if (millis() - homing_start_time_ > HOMING_TIMEOUT) {
+      ESP_LOGW("MotorController", "Homing timeout - failed to find home switch");
+      stop_azimuth_motor();
+      homing_active_ = false;
+      return;
+    }
+    
+    switch (homing_phase_) {
+      case HOMING_MOVE_OFF_SWITCH:
+        // If we're on the switch, back off slowly
+        if (is_home_switch_pressed()) {
+          run_azimuth_cw();  // Move away from switch
+          
+          if (millis() - homing_phase_start_ > HOMING_BACKOFF_TIME) {
+            ESP_LOGW("MotorController", "Failed to move off home switch");
+            stop_azimuth_motor();
+            homing_active_ = false;
+          }
+        } else {
+          // Successfully moved off switch
+          stop_azimuth_motor();
+          delay(200);
+          homing_phase_ = HOMING_SEEK_SWITCH;
+          homing_phase_start_ = millis();
+          ESP_LOGD("MotorController", "Moved off switch, now seeking...");
+        }
+        break;
+        
+      case HOMING_SEEK_SWITCH:
+        // Move CCW until switch is found
+        if (is_home_switch_pressed()) {
+          // Found the switch! Move to slow approach
+          stop_azimuth_motor();
+          delay(200);
+          homing_phase_ = HOMING_SLOW_APPROACH;
+          homing_phase_start_ = millis();
+          ESP_LOGD("MotorController", "Home switch found, backing off for slow approach...");
+          
+          // Back off a bit
+          run_azimuth_cw();
+          delay(500);
+          stop_azimuth_motor();
+          delay(200);
+        } else {
+          // Keep moving CCW
+          run_azimuth_ccw();
+        }
+        break;
+        
+      case HOMING_SLOW_APPROACH:
+        // Slowly approach the switch with pulses
+        if (is_home_switch_pressed()) {
+          // Switch triggered!
+          stop_azimuth_motor();
+          homing_phase_ = HOMING_SET_ZERO;
+          homing_phase_start_ = millis();
+          ESP_LOGI("MotorController", "Home position found!");
+        } else {
+          // Pulse CCW slowly
+          run_azimuth_ccw();
+          delay(HOMING_SLOW_APPROACH_TIME);
+          stop_azimuth_motor();
+          delay(100);
+        }
+        break;
+        
+      case HOMING_SET_ZERO:
+        // Wait for things to settle, then set zero position
+        if (millis() - homing_phase_start_ > HOMING_SETTLE_TIME) {
+          // Set current position as home (0 degrees)
+          set_azimuth_zero();
+          homing_phase_ = HOMING_COMPLETE;
+          ESP_LOGI("MotorController", "Azimuth homed successfully - zero position set");
+        }
+        break;
+        
+      case HOMING_COMPLETE:
+        homing_active_ = false;
+        azimuth_homed_ = true;
+        break;
+    }
+  }
+
+  // Azimuth moves need a completed homing run and must not fight the homing sequence
+  bool is_azimuth_ready() {
+    return azimuth_homed_ && !homing_active_;
+  }
+
+  bool is_home_switch_pressed() {
+    // Switch is active LOW (pressed = LOW, released = HIGH with pullup)
+    return gpio_get_level(gpio_pin(Config::HOME_SWITCH_PIN)) == 0;
+  }
+
+  void set_azimuth_zero() {
+    // Tell the HWT905 sensor that current position is home (0 degrees)
+    // We'll store an offset to apply to all future readings
+    float current_heading = hwt905_->get_current_heading();
+    azimuth_home_offset_ = current_heading;
+    ESP_LOGI("MotorController", "Home offset set to %.2f°", azimuth_home_offset_);
+  }
+
+  float get_corrected_azimuth() {
+    // Get heading with home offset applied
+    float raw_heading = hwt905_->get_current_heading();
+    float corrected = raw_heading - azimuth_home_offset_;
+    
+    // Normalize to 0-360
+    while (corrected < 0) corrected += 360.0;
+    while (corrected >= 360.0) corrected -= 360.0;
+    
+    return corrected;
+  }
+
+  void check_safety_timeout() {
+    if (elevation_active_ && (millis() - elevation_start_time_ > MOTOR_TIMEOUT)) {
+      ESP_LOGW("MotorController", "Elevation motor timeout - stopping");
+      stop_elevation_motor();
+      elevation_active_ = false;
+    }
+    
+    if (azimuth_active_ && (millis() - azimuth_start_time_ > MOTOR_TIMEOUT)) {
+      ESP_LOGW("MotorController", "Azimuth motor timeout - stopping");
+      stop_azimuth_motor();
+      azimuth_active_ = false;
+    }
+    
+    if (homing_active_ && (millis() - homing_start_time_ > HOMING_TIMEOUT)) {
+      ESP_LOGW("MotorController", "Homing timeout - stopping");
+      stop_azimuth_motor();
+      homing_active_ = false;
+    }
+  }
+
+  // GPIO access goes straight to the ESP-IDF driver with the constexpr pin numbers
+  static gpio_num_t gpio_pin(int pin) {
+    return static_cast<gpio_num_t>(pin);
+  }
+
+  static void setup_output_pin(int pin) {
+    gpio_reset_pin(gpio_pin(pin));
+    gpio_set_direction(gpio_pin(pin), GPIO_MODE_OUTPUT);
+    gpio_set_level(gpio_pin(pin), 0);
+  }
+
+  static void set_pin(int pin, bool high) {
+    gpio_set_level(gpio_pin(pin), high ? 1 : 0);
+  }
+
+  // Motor control primitives
+  // Every start/stop goes through these so motor on-time and starts are measured
+  void run_elevation_forward() {
+    mark_elevation_motor_on();
+    set_pin(Config::ELEVATION_FORWARD_PIN, true);
+    set_pin(Config::ELEVATION_BACKWARD_PIN, false);
+  }
+
+  void run_elevation_backward() {
+    mark_elevation_motor_on();
+    set_pin(Config::ELEVATION_FORWARD_PIN, false);
+    set_pin(Config::ELEVATION_BACKWARD_PIN, true);
+  }
+
+  void stop_elevation_motor() {
+    set_pin(Config::ELEVATION_FORWARD_PIN, false);
+    set_pin(Config::ELEVATION_BACKWARD_PIN, false);
+    
+    if (elevation_motor_running_) {
+      elevation_on_time_ms_ += millis() - elevation_motor_on_since_;
+      elevation_motor_running_ = false;
+    }
+  }
+
+  void run_azimuth_burst_cw() {
+    run_azimuth_cw();
+    delay(AZIMUTH_BURST_TIME);
+    stop_azimuth_motor();
+  }
+
+  void run_azimuth_burst_ccw() {
+    run_azimuth_ccw();
+    delay(AZIMUTH_BURST_TIME);
+    stop_azimuth_motor();
+  }
+
+  void stop_azimuth_motor() {
+    set_pin(Config::AZIMUTH_CW_PIN, false);
+    set_pin(Config::AZIMUTH_CCW_PIN, false);
+    
+    if (azimuth_motor_running_) {
+      azimuth_on_time_ms_ += millis() - azimuth_motor_on_since_;
+      azimuth_motor_running_ = false;
+    }
+  }
+  
+  // Continuous motor control (for homing)
+  void run_azimuth_cw() {
+    mark_azimuth_motor_on();
+    set_pin(Config::AZIMUTH_CW_PIN, true);
+    set_pin(Config::AZIMUTH_CCW_PIN, false);
+  }
+  
+  void run_azimuth_ccw() {
+    mark_azimuth_motor_on();
+    set_pin(Config::AZIMUTH_CW_PIN, false);
+    set_pin(Config::AZIMUTH_CCW_PIN, true);
+  }
+
+  void mark_elevation_motor_on() {
+    if (!elevation_motor_running_) {
+      elevation_motor_running_ = true;
+      elevation_motor_on_since_ = millis();
+      motor_starts_++;
+    }
+  }
+
+  void mark_azimuth_motor_on() {
+    if (!azimuth_motor_running_) {
+      azimuth_motor_running_ = true;
+      azimuth_motor_on_since_ = millis();
+      motor_starts_++;
+    }
+  }
+};
+
+}  // namespace solar_tracker
+}  // namespace esphome
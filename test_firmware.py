@@ -193,6 +193,182 @@ def test_home_offset_calculation():
     
     print("  ✓ Home offset calculation OK\n")
 
+def test_vibration_monitor():
+    """Test streaming vibration statistics and wind stow hysteresis"""
+    print("Testing Vibration Monitor...")
+    
+    import random
+    from collections import deque
+    
+    window = 32
+    
+    # Incremental sums and monotonic queues, as in VibrationMonitor
+    samples = deque()
+    total, total_sq = 0, 0
+    max_q, min_q = deque(), deque()
+    
+    random.seed(1)
+    for seq in range(500):
+        value = random.randint(-32768, 32767) if seq < 250 else random.randint(-50, 50)
+        
+        samples.append(value)
+        total += value
+        total_sq += value * value
+        if len(samples) > window:
+            old = samples.popleft()
+            total -= old
+            total_sq -= old * old
+        
+        while max_q and seq - max_q[0][0] >= window:
+            max_q.popleft()
+        while max_q and max_q[-1][1] <= value:
+            max_q.pop()
+        max_q.append((seq, value))
+        while min_q and seq - min_q[0][0] >= window:
+            min_q.popleft()
+        while min_q and min_q[-1][1] >= value:
+            min_q.pop()
+        min_q.append((seq, value))
+        
+        n = len(samples)
+        mean = sum(samples) / n
+        naive_var = sum((s - mean) ** 2 for s in samples) / n
+        stream_var = (n * total_sq - total * total) / (n * n)
+        assert abs(stream_var - naive_var) < 1e-6 * max(1.0, naive_var), "Streaming variance mismatch"
+        assert max_q[0][1] - min_q[0][1] == max(samples) - min(samples), "Peak-to-peak mismatch"
+    
+    print("  Streaming variance and peak-to-peak match naive window over 500 samples")
+    
+    # Hysteresis on the windowed peak-to-peak at 100Hz (10ms per sample)
+    def run_stow(signal, trigger_time, window=32, calm_time=1000):
+        trigger, release = 8.0, 4.0
+        recent = deque(maxlen=window)
+        stowed = False
+        high_since = calm_since = None
+        events = []
+        for i, value in enumerate(signal):
+            t = i * 10
+            recent.append(value)
+            p2p = max(recent) - min(recent)
+            if not stowed:
+                if p2p < trigger:
+                    high_since = None
+                else:
+                    high_since = t if high_since is None else high_since
+                    if t - high_since >= trigger_time:
+                        stowed, calm_since = True, None
+                        events.append(("stow", t))
+            else:
+                if p2p > release:
+                    calm_since = None
+                else:
+                    calm_since = t if calm_since is None else calm_since
+                    if t - calm_since >= calm_time:
+                        stowed, high_since = False, None
+                        events.append(("resume", t))
+        return events
+    
+    # Single 10 m/s² spike at 0.5s, then sustained ±5 m/s² from 1.0s to 2.0s
+    signal = [0.0] * 400
+    signal[50] = 10.0
+    for i in range(100, 200):
+        signal[i] = 5.0 if i % 2 else -5.0
+    
+    # A trigger time shorter than the window (32 samples = 320ms) stows on the spike
+    spike_events = run_stow(signal, trigger_time=300)
+    print(f"  Trigger 300ms (< window): {spike_events}")
+    assert spike_events and spike_events[0] == ("stow", 800), "Expected the spike to stow"
+    
+    events = run_stow(signal, trigger_time=500)
+    print(f"  Trigger 500ms (> window): {events}")
+    assert events == [("stow", 1510), ("resume", 3310)], "Wind stow hysteresis failed"
+    
+    print("  ✓ Vibration monitor OK\n")
+
+def test_move_scheduler():
+    """Test energy-aware move scheduling (cosine gain vs motor cost)"""
+    print("Testing Move Scheduler...")
+    
+    import math
+    
+    panel_power = 400.0
+    horizon = 900.0
+    min_gain_ratio = 1.0
+    elevation_power, azimuth_power = 48.0, 72.0
+    start_cost = 5.0
+    elevation_rate, azimuth_rate = 0.5, 0.5
+    burst_time = 300
+    elevation_tolerance, azimuth_tolerance = 0.5, 2.0
+    
+    def pointing_cosine(e1, a1, e2, a2):
+        e1, e2, da = math.radians(e1), math.radians(e2), math.radians(a2 - a1)
+        return math.sin(e1) * math.sin(e2) + math.cos(e1) * math.cos(e2) * math.cos(da)
+    
+    def move_cost(elev_deg, azi_deg):
+        cost = 0.0
+        if elev_deg > 0:
+            cost += elev_deg / elevation_rate * elevation_power + start_cost
+        if azi_deg > 0:
+            seconds = azi_deg / azimuth_rate
+            cost += seconds * azimuth_power + math.ceil(seconds * 1000 / burst_time) * start_cost
+        return cost
+    
+    def azimuth_error(current, target):
+        error = target - current
+        if error > 180:
+            error -= 360
+        elif error < -180:
+            error += 360
+        return error
+    
+    # Mirrors update_move_scheduler(): wrapped azimuth error, per-axis tolerance
+    def should_move(cur_e, cur_a, tgt_e, tgt_a):
+        elevation_error = abs(tgt_e - cur_e)
+        azi_error = abs(azimuth_error(cur_a, tgt_a))
+        move_elevation = elevation_error >= elevation_tolerance
+        move_azimuth = azi_error >= azimuth_tolerance
+        if not move_elevation and not move_azimuth:
+            return False
+        gain = panel_power * (1 - pointing_cosine(cur_e, cur_a, tgt_e, tgt_a)) * horizon
+        cost = move_cost(elevation_error if move_elevation else 0.0,
+                         azi_error if move_azimuth else 0.0)
+        return gain >= min_gain_ratio * cost
+    
+    test_cases = [
+        ((45, 180, 46, 180), False),   # 1° elevation - not worth a motor start
+        ((45, 180, 50, 180), True),    # 5° elevation - clear gain
+        ((45, 180, 45, 185), False),   # 5° azimuth at 45° sun is only ~3.5° off-axis
+        ((45, 180, 45, 195), True),    # 15° azimuth
+        ((80, 180, 80, 200), False),   # Azimuth barely matters near zenith
+        ((20, 350, 20, 5), True),      # 15° azimuth across 0/360, not 345°
+        ((20, 355, 20, 340), True),    # Same going the other way
+        ((60, 180, 60.4, 181.5), False),  # Both axes inside tolerance
+    ]
+    
+    for (cur_e, cur_a, tgt_e, tgt_a), expected in test_cases:
+        result = should_move(cur_e, cur_a, tgt_e, tgt_a)
+        loss = (1 - pointing_cosine(cur_e, cur_a, tgt_e, tgt_a)) * 100
+        print(f"  ({cur_e}°, {cur_a}°) → ({tgt_e}°, {tgt_a}°): loss {loss:.3f}%, "
+              f"{'move' if result else 'defer'} (expected: {'move' if expected else 'defer'})")
+        assert result == expected, "Move scheduling decision failed"
+    
+    # A protective stow is not about pointing gain: a short drop to flat fails
+    # the check, which is why stow() and set_elevation(0) skip the scheduler
+    assert not should_move(1, 180, 0, 180), "Stow would have passed the gain check"
+    print("  Stow 1° → 0° would be deferred by the gain check - stows bypass it")
+    
+    # Sun moving ~1.25° per 5 minute update: deferred commands merge into fewer moves
+    elevation, moves = 30.0, 0
+    for update in range(1, 13):
+        sun = 30.0 + 1.25 * update
+        if should_move(elevation, 180, sun, 180):
+            elevation = sun
+            moves += 1
+    print(f"  12 sun updates executed as {moves} moves")
+    assert 0 < moves < 12, "Deferred moves were not merged"
+    
+    print("  ✓ Move scheduler OK\n")
+
 def print_pin_configuration():
     """Print pin configuration summary"""
     print("Pin Configuration Summary:")
@@ -256,7 +432,7 @@ def print_calibration_sequence():
     print("HWT905 Calibration Sequence:")
     print("=" * 50)
     commands = [
-        ("Unlock Config", [0xFF, 0xAA, 0x69, 0xB5, 0x88]),
+        ("Unlock Config", [0xFF, 0xAA, 0x69, 0x88, 0xB5]),
         ("Start Accel Cal", [0xFF, 0xAA, 0x01, 0x01, 0x00]),
         ("Wait 5 seconds", None),
         ("Exit Accel Cal", [0xFF, 0xAA, 0x01, 0x00, 0x00]),
@@ -286,6 +462,8 @@ def main():
         test_safety_features()
         test_homing_state_machine()
         test_home_offset_calculation()
+        test_vibration_monitor()
+        test_move_scheduler()
         
         print("\n" + "=" * 60)
         print("✓ All tests passed!")